@@ -47,6 +47,17 @@ NeopixelWrapper strips[] = {
 // Combines the strips to a single strip
 MultilineWrapper strip(strips, 4);
 
+// Sparse updates around the strip boundaries. Index 61 occurs twice
+// (the last entry wins) and index 240 is out of range and ignored.
+PixelUpdate sparkles[] = {
+    { 59, Adafruit_NeoPixel::Color(255, 0, 0) },
+    { 60, Adafruit_NeoPixel::Color(0, 255, 0) },
+    { 61, Adafruit_NeoPixel::Color(0, 0, 255) },
+    { 61, Adafruit_NeoPixel::Color(255, 0, 255) },
+    { 119, Adafruit_NeoPixel::Color(0, 255, 255) },
+    { 240, Adafruit_NeoPixel::Color(255, 255, 0) },
+};
+
 void setup() {
   strip.begin();
 }
@@ -55,6 +66,10 @@ void loop() {
     strip.clear();
     strip.fill(Adafruit_NeoPixel::Color(255, 255, 255));
     strip.show();
+
+    // Only the first two strips are touched and shown again
+    uint32_t touched = strip.setPixelColors(sparkles, 6);
+    strip.show(touched);
 }
 
 #endif
@@ -118,11 +118,11 @@ void MultilineWrapper::setWrappers(NeopixelWrapper *pwrappers, uint8_t stripCoun
     indexMap = (uint8_t**) malloc(pixelCount * sizeof(uint8_t*));
     if (indexMap) // allocation successful
     {
-        uint8_t rawIndex = 0;
+        uint16_t rawIndex = 0;
         for (uint8_t stripIndex = 0;
             stripIndex < stripCount; stripIndex++)
         {
-            for (uint8_t lineIndex = 0;
+            for (uint16_t lineIndex = 0;
                 lineIndex < wrappers[stripIndex].numPixels(); lineIndex++)
             {
                 indexMap[rawIndex] = wrappers[stripIndex]
@@ -169,6 +169,47 @@ void MultilineWrapper::setPixelColor(uint16_t n, uint32_t c)
     if(!isRGB()) stripIndex[wOffset] = 0;
 }
 
+uint32_t MultilineWrapper::setPixelColors(const PixelUpdate *updates, uint16_t count)
+{
+    // Loads the offsets once instead of once per pixel
+    uint8_t r = rOffset, g = gOffset, b = bOffset, w = wOffset;
+    bool rgb = isRGB();
+
+    // Tracks the updated index range instead of looking up the strip
+    // of every single update. This keeps the loop as cheap as a plain
+    // setPixelColor loop.
+    uint16_t lowest = 0xFFFF, highest = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint16_t n = updates[i].index;
+        if (n >= pixelCount) continue;
+        if (n < lowest) lowest = n;
+        if (n > highest) highest = n;
+
+        uint32_t c = updates[i].color;
+        uint8_t *p = indexMap[n];
+        p[r] = (uint8_t)(c >> 16);
+        p[g] = (uint8_t)(c >>  8);
+        p[b] = (uint8_t)(c);
+        if (!rgb) p[w] = 0;
+    }
+
+    // Marks every strip that overlaps the updated index range
+    uint32_t touched = 0;
+    uint16_t stripStart = 0;
+    for (uint8_t stripIndex = 0;
+        stripIndex < wrapperCount && stripStart <= highest; stripIndex++)
+    {
+        uint16_t stripEnd = stripStart + wrappers[stripIndex].numPixels();
+        if (lowest < stripEnd)
+        {
+            touched |= 1UL << (stripIndex < 31 ? stripIndex : 31);
+        }
+        stripStart = stripEnd;
+    }
+    return touched;
+}
+
 void MultilineWrapper::fill(int32_t c)
 {
     int8_t r = (uint8_t)(c >> 16);
@@ -219,6 +260,17 @@ void MultilineWrapper::show()
     }
 }
 
+void MultilineWrapper::show(uint32_t stripMask)
+{
+    for (uint8_t i = 0; i < wrapperCount; i++)
+    {
+        if (stripMask & (1UL << (i < 31 ? i : 31)))
+        {
+            wrappers[i].show();
+        }
+    }
+}
+
 void MultilineWrapper::clear()
 {
     for (uint16_t i = 0; i < pixelCount; i++)
@@ -128,7 +128,7 @@ public:
 
     /// Returns the number of pixels in this strip. This function
     /// wraps the Adafruit_NeoPixel::numPixels function.
-    inline int8_t numPixels() { return Adafruit_NeoPixel::numPixels(); }
+    inline uint16_t numPixels() { return Adafruit_NeoPixel::numPixels(); }
 
     /// (begin) wraps Adafruit_NeoPixel::begin function
     /// (show) wraps Adafruit_NeoPixel::show function
@@ -144,6 +144,16 @@ public:
     inline void updateType(neoPixelType t) { Adafruit_NeoPixel::updateType(t); }
 };
 
+/// struct PixelUpdate
+/// A single entry of a batched pixel update. It stores the virtual
+/// index of the pixel and the packed color that should be assigned.
+/// See MultilineWrapper::setPixelColors for more information.
+struct PixelUpdate
+{
+    uint16_t index;
+    uint32_t color;
+};
+
 /// class MultilineWrapper
 /// This class encloses and manages multiple NeopixelWrapper objects.
 /// It is used to chain multiple strips together to form a combined
@@ -207,6 +217,17 @@ public:
     void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
     void setPixelColor(uint16_t n, uint32_t c);
 
+    /// Sets the colors of multiple scattered pixels at once. The updates
+    /// are applied in the given order, so the last entry wins if an index
+    /// occurs multiple times. Updates with an index out of range are ignored.
+    /// The given array is not modified.
+    ///
+    /// Returns a bitmask of the strips that may have changed, where bit i
+    /// stands for strip i. It contains every strip between the lowest and
+    /// the highest updated index. Strips 31 and above all share bit 31.
+    /// The mask can be passed to show(uint32_t) to skip unchanged strips.
+    uint32_t setPixelColors(const PixelUpdate *updates, uint16_t count);
+
     /// (1) Fills the whole strip with the given color. This functions does not
     /// follow special behaviour for an inversed strip.
     /// (2) Fills the strip from a beginning point to the end.
@@ -216,9 +237,12 @@ public:
     void fill(int32_t color, int16_t start, uint16_t count);
 
     /// (1) Calls the show method of all underlying wrapper objects.
-    /// (2) Calls the begin method of all underlying wrapper objects.
-    /// (3) Calls the clear method of all underlying wrapper objects.
+    /// (2) Calls the show method of the wrapper objects selected by the
+    /// given strip mask. See setPixelColors for the mask layout.
+    /// (3) Calls the begin method of all underlying wrapper objects.
+    /// (4) Calls the clear method of all underlying wrapper objects.
     void show();
+    void show(uint32_t stripMask);
     void begin();
     void clear();
 };